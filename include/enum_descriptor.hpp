@@ -52,6 +52,13 @@ namespace fp {
         }
     };
 
+    namespace detail {
+
+        constexpr std::size_t str_length(char const * s, std::size_t n = 0) {
+            return s[n] ? str_length(s, n + 1) : n;
+        }
+    }
+
     template<typename Enum>
     struct enum_entry {
     public:
@@ -60,10 +67,15 @@ namespace fp {
     private:
         Enum _value;
         char const * const _name;
+        std::size_t const _length;
     public:
 
         constexpr enum_entry(Enum value, char const * name) noexcept
-        : _value(value), _name(name)
+        : _value(value), _name(name), _length(detail::str_length(name))
+        { }
+
+        constexpr enum_entry(Enum value, char const * name, std::size_t length) noexcept
+        : _value(value), _name(name), _length(length)
         { }
 
         constexpr enum_entry(enum_entry const &) noexcept = default;
@@ -74,6 +86,9 @@ namespace fp {
         constexpr char const * name() const
         { return _name; }
 
+        constexpr std::size_t length() const
+        { return _length; }
+
         constexpr explicit operator underlying_type() const
         { return static_cast<underlying_type>(_value); }
     };
@@ -90,6 +105,12 @@ namespace fp {
         struct enum_descriptor_impl<T, typename std::enable_if<!std::is_same<void, decltype(get_descriptor_mapping(std::declval<T&>()))>::value>::type> {
             using type = decltype(get_descriptor_mapping(std::declval<T&>()));
         };
+
+        template<typename, typename = void>
+        struct has_descriptor : std::false_type { };
+
+        template<typename T>
+        struct has_descriptor<T, typename std::enable_if<!std::is_same<void, typename enum_descriptor_impl<T>::type>::value>::type> : std::true_type { };
     }
 
     /**
@@ -128,6 +149,12 @@ namespace fp {
          */
         constexpr static enum_type value_of(char const *);
 
+        /**
+         * Finds the entry associated with value
+         * @return  pointer to the entry associated with value, or end() if there is none
+         */
+        constexpr static const_iterator find(enum_type);
+
         /**
          * Gets the number of entries in Enum
          * @return  number of entries in Enum
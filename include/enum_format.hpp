@@ -0,0 +1,130 @@
+#ifndef FP_ENUM_FORMAT_HPP_
+#define FP_ENUM_FORMAT_HPP_
+
+#include "enum_descriptor.hpp"
+
+#include <cstddef>      // for std::size_t
+#include <cstring>      // for std::memcpy
+#include <limits>       // for std::numeric_limits
+#include <ostream>      // for std::ostream
+#include <system_error> // for std::errc
+#include <type_traits>  // for std::enable_if, std::underlying_type
+
+#if defined(__has_include)
+#  if __has_include(<charconv>) && (__cplusplus >= 201703L)
+#    include <charconv>
+#  endif
+#  if __has_include(<format>)
+#    include <format>
+#  endif
+#endif
+
+namespace fp {
+
+#if defined(__cpp_lib_to_chars)
+    using to_chars_result = std::to_chars_result;
+#else
+    struct to_chars_result {
+        char * ptr;
+        std::errc ec;
+    };
+#endif
+
+    namespace detail {
+
+        template<typename T>
+        to_chars_result integer_to_chars(char * first, char * last, T value) {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            char buffer[std::numeric_limits<unsigned_type>::digits10 + 2];
+            char * const buffer_end = buffer + sizeof(buffer);
+            char * it = buffer_end;
+            unsigned_type magnitude = (value < 0)
+                ? static_cast<unsigned_type>(unsigned_type(0) - static_cast<unsigned_type>(value))
+                : static_cast<unsigned_type>(value);
+            do {
+                *--it = static_cast<char>('0' + (magnitude % 10));
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (value < 0) {
+                *--it = '-';
+            }
+            std::size_t const length = static_cast<std::size_t>(buffer_end - it);
+            if (static_cast<std::size_t>(last - first) < length) {
+                return to_chars_result{ last, std::errc::value_too_large };
+            }
+            std::memcpy(first, it, length);
+            return to_chars_result{ first + length, std::errc() };
+        }
+    }
+
+    /**
+     * Writes the name of value into [first, last)
+     * Values that are not an entry of Enum are written as their underlying integral value.
+     * @param   first   start of the destination range
+     * @param   last    end of the destination range
+     * @param   value   value to be written
+     * @return  one-past-end of the written characters, or last and std::errc::value_too_large
+     *          if the destination range is too small
+     */
+    template<typename Enum, typename = typename std::enable_if<detail::has_descriptor<Enum>::value>::type>
+    to_chars_result to_chars(char * first, char * last, Enum value) {
+        using descriptor_type = DescriptorOf<Enum>;
+        auto const entry = descriptor_type::find(value);
+        if (entry == descriptor_type::end()) {
+            return detail::integer_to_chars(first, last, static_cast<typename std::underlying_type<Enum>::type>(value));
+        }
+        if (static_cast<std::size_t>(last - first) < entry->length()) {
+            return to_chars_result{ last, std::errc::value_too_large };
+        }
+        std::memcpy(first, entry->name(), entry->length());
+        return to_chars_result{ first + entry->length(), std::errc() };
+    }
+
+    namespace detail {
+
+        template<typename Enum>
+        std::ostream & write_enum(std::ostream & os, Enum value) {
+            using descriptor_type = DescriptorOf<Enum>;
+            auto const entry = descriptor_type::find(value);
+            if (entry == descriptor_type::end()) {
+                return os << +static_cast<typename std::underlying_type<Enum>::type>(value);
+            }
+            // only padded output needs the formatted path, everything else is a single write
+            return (os.width() != 0)
+                ? (os << entry->name())
+                : os.write(entry->name(), static_cast<std::streamsize>(entry->length()));
+        }
+    }
+}
+
+/**
+ * Defines operator<< for a described enum, must be used in the namespace of ENUM
+ * so that argument-dependent lookup finds the operator from any context
+*/
+#define FP_DEFINE_ENUM_OSTREAM(ENUM)                                                            \
+    inline std::ostream & operator<<(std::ostream & os, ENUM value) {                           \
+        return ::fp::detail::write_enum(os, value);                                             \
+    }
+
+#if defined(__cpp_lib_format)
+
+template<typename Enum>
+    requires ::fp::detail::has_descriptor<Enum>::value
+struct std::formatter<Enum, char> : std::formatter<std::string_view, char> {
+    template<typename FormatContext>
+    auto format(Enum value, FormatContext & ctx) const {
+        using descriptor_type = ::fp::DescriptorOf<Enum>;
+        using base_type = std::formatter<std::string_view, char>;
+        auto const entry = descriptor_type::find(value);
+        if (entry == descriptor_type::end()) {
+            char buffer[std::numeric_limits<std::underlying_type_t<Enum>>::digits10 + 3];
+            auto const res = ::fp::detail::integer_to_chars(buffer, buffer + sizeof(buffer), static_cast<std::underlying_type_t<Enum>>(value));
+            return base_type::format(std::string_view(buffer, static_cast<std::size_t>(res.ptr - buffer)), ctx);
+        }
+        return base_type::format(std::string_view(entry->name(), entry->length()), ctx);
+    }
+};
+
+#endif
+
+#endif
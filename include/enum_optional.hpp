@@ -0,0 +1,132 @@
+#ifndef FP_ENUM_OPTIONAL_HPP_
+#define FP_ENUM_OPTIONAL_HPP_
+
+#include "enum_descriptor.hpp"
+
+#include <cassert>      // for assert
+#include <limits>       // for std::numeric_limits
+#include <stdexcept>    // for std::logic_error
+#include <type_traits>  // for std::underlying_type
+
+namespace fp {
+
+    template<typename Enum>
+    struct EmptyEnumOptionalException : std::logic_error {
+    private:
+        using base_type = std::logic_error;
+    public:
+        EmptyEnumOptionalException()
+        : base_type("access to empty enum_optional")
+        { }
+    };
+
+    namespace detail {
+
+        template<typename Enum>
+        struct enum_niche {
+        public:
+            using descriptor_type = DescriptorOf<Enum>;
+            using underlying_type = typename std::underlying_type<Enum>::type;
+        private:
+            constexpr static underlying_type find(underlying_type v) {
+                return descriptor_type::is_valid(v)
+                    ? ((v == std::numeric_limits<underlying_type>::min())
+                        ? throw std::logic_error("no unused value available for Enum")
+                        : find(v - 1))
+                    : v;
+            }
+        public:
+            // Highest value of the underlying type that is not an entry of Enum
+            constexpr static underlying_type value = find(std::numeric_limits<underlying_type>::max());
+        };
+
+        template<typename Enum>
+        constexpr typename enum_niche<Enum>::underlying_type enum_niche<Enum>::value;
+    }
+
+    /**
+     * Optional Enum without storage overhead
+     * An unused value of Enum (as known by its descriptor) marks the empty state,
+     * so enum_optional<Enum> has the same size and alignment as Enum.
+     * @param  Enum    type of enum, must have a descriptor
+    */
+    template<typename Enum>
+    struct enum_optional {
+    public:
+        using enum_type = Enum;
+        using underlying_type = typename std::underlying_type<enum_type>::type;
+        using this_type = enum_optional<enum_type>;
+    private:
+        enum_type _value;
+
+        constexpr static enum_type empty_value() noexcept
+        { return static_cast<enum_type>(detail::enum_niche<enum_type>::value); }
+    public:
+        /**
+         * Constructs an empty enum_optional
+        */
+        constexpr enum_optional() noexcept
+        : _value(empty_value())
+        { }
+
+        /**
+         * Constructs an enum_optional holding value
+         * value may be any value except the one used to mark the empty state (the highest
+         * underlying value that is not an entry of Enum); holding that value would make
+         * the enum_optional empty, which is asserted against in debug builds.
+         * @param   value   value to be held
+        */
+        constexpr enum_optional(enum_type value) noexcept
+        : _value((assert(value != empty_value()), value))
+        { }
+
+        constexpr enum_optional(enum_optional const &) noexcept = default;
+        enum_optional & operator=(enum_optional const &) noexcept = default;
+
+        /**
+         * Checks whether or not a value is held
+         * @return  whether or not a value is held
+        */
+        constexpr bool has_value() const noexcept
+        { return _value != empty_value(); }
+
+        constexpr explicit operator bool() const noexcept
+        { return has_value(); }
+
+        /**
+         * Gets the held value
+         * @return  held value
+        */
+        constexpr enum_type value() const
+        { return has_value() ? _value : throw EmptyEnumOptionalException<enum_type>(); }
+
+        /**
+         * Gets the held value, or def if no value is held
+         * @param   def     value to be returned if no value is held
+         * @return  held value or def
+        */
+        constexpr enum_type value_or(enum_type def) const noexcept
+        { return has_value() ? _value : def; }
+
+        /**
+         * Gets the held value without checking whether a value is held
+         * @return  held value
+        */
+        constexpr enum_type operator*() const noexcept
+        { return _value; }
+
+        /**
+         * Empties the enum_optional
+        */
+        void reset() noexcept
+        { _value = empty_value(); }
+
+        friend constexpr bool operator==(enum_optional const & l, enum_optional const & r) noexcept
+        { return l._value == r._value; }
+
+        friend constexpr bool operator!=(enum_optional const & l, enum_optional const & r) noexcept
+        { return l._value != r._value; }
+    };
+}
+
+#endif
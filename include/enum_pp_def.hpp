@@ -42,6 +42,16 @@ namespace fp {
 
     public:
 
+        constexpr static enum_entry<Enum> const * find(Enum, enum_entry<Enum> const * last)
+        { return last; }
+
+        template<typename H, typename... T>
+        constexpr static enum_entry<Enum> const * find(Enum v, enum_entry<Enum> const * last, H const & head, T const &... tail) {
+            return (head.value() == v)
+                ? &head
+                : find(v, last, tail...);
+        }
+
         template<typename H, typename... T>
         constexpr static char const * get_name(Enum v, H const & head, T const &... tail) {
             return (head.value() == v) 
@@ -95,11 +105,11 @@ namespace fp {
 #define FP_PP_ENUM_STD_ENTRY_(N, ENUM, VALUE)           FP_PP_ENUM_STD_ENTRY__(N, ENUM, FP_PP_EXPAND VALUE)
 #define FP_PP_ENUM_STD_ENTRY(ENUM, VALUE)               FP_PP_ENUM_STD_ENTRY_(FP_PP_NUM_ARGS VALUE, ENUM, VALUE)
 
-#define FP_PP_ENUM_EXT_ENTRY_WITHOUT_VALUE__(ENUM, NAME)      ::fp::enum_entry<ENUM>(ENUM::NAME, #NAME),
+#define FP_PP_ENUM_EXT_ENTRY_WITHOUT_VALUE__(ENUM, NAME)      ::fp::enum_entry<ENUM>(ENUM::NAME, #NAME, sizeof(#NAME) - 1),
 #define FP_PP_ENUM_EXT_ENTRY_WITHOUT_VALUE_(ENUM, NAME)       FP_PP_ENUM_EXT_ENTRY_WITHOUT_VALUE__(ENUM, NAME)
 #define FP_PP_ENUM_EXT_ENTRY_WITHOUT_VALUE(ENUM, SPLIT...)    FP_PP_ENUM_EXT_ENTRY_WITHOUT_VALUE_(ENUM, SPLIT)
 
-#define FP_PP_ENUM_EXT_ENTRY_WITH_VALUE__(ENUM, NAME, VALUE)  ::fp::enum_entry<ENUM>(ENUM::NAME, #NAME),
+#define FP_PP_ENUM_EXT_ENTRY_WITH_VALUE__(ENUM, NAME, VALUE)  ::fp::enum_entry<ENUM>(ENUM::NAME, #NAME, sizeof(#NAME) - 1),
 #define FP_PP_ENUM_EXT_ENTRY_WITH_VALUE_(ENUM, NAME, VALUE)   FP_PP_ENUM_EXT_ENTRY_WITH_VALUE__(ENUM, NAME, VALUE)
 #define FP_PP_ENUM_EXT_ENTRY_WITH_VALUE(ENUM, SPLIT...)       FP_PP_ENUM_EXT_ENTRY_WITH_VALUE_(ENUM, SPLIT)
 
@@ -136,6 +146,11 @@ namespace fp {
         }                                                                                       \
                                                                                                 \
         template<std::size_t... Is >                                                            \
+        constexpr static const_iterator find_impl(enum_type v, ::fp::indices<Is...>) {          \
+            return ::fp::enum_helper<enum_type>::find(v, end(), _entries[Is]...);               \
+        }                                                                                       \
+                                                                                                \
+        template<std::size_t... Is >                                                            \
         constexpr static enum_type value_of_impl(char const * n, ::fp::indices<Is...>) {        \
             return ::fp::enum_helper<enum_type>::get_value(n, _entries[Is]...);                 \
         }                                                                                       \
@@ -173,6 +188,10 @@ namespace fp {
             return value_of_impl(name, ::fp::build_indices<Size>());                            \
         }                                                                                       \
                                                                                                 \
+        constexpr static const_iterator find(enum_type value) {                                 \
+            return find_impl(value, ::fp::build_indices<Size>());                               \
+        }                                                                                       \
+                                                                                                \
         constexpr static size_type size() noexcept {                                            \
             return Size;                                                                        \
         }                                                                                       \
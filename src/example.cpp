@@ -1,10 +1,14 @@
 #include "../include/enum_pp_def.hpp"
+#include "../include/enum_optional.hpp"
+#include "../include/enum_format.hpp"
 
 #include <iostream>
+#include <type_traits>
 
 namespace ext {
     DEFINE_EXT_ENUM(my_1st_enum, (fread, 3), (fwrite), (fflush, fread << 2));
     DEFINE_EXT_ENUM(my_2nd_enum, (fopen), (fclose, 1));
+    FP_DEFINE_ENUM_OSTREAM(my_1st_enum); // opt-in operator<<
 }
 
 int main(int argc, char ** argv) {
@@ -29,6 +33,25 @@ int main(int argc, char ** argv) {
         std::cout << "-- " << (int) descr.value_of(it->name()) << " = " << it->name() << std::endl; // find by name
     }
     std::cout << std::endl;
+    // optional entry without storage overhead
+    using optional_t = fp::enum_optional<descriptor_t::enum_type>;
+    static_assert(sizeof(optional_t) == sizeof(descriptor_t::enum_type), "enum_optional must not add storage");
+    static_assert(alignof(optional_t) == alignof(descriptor_t::enum_type), "enum_optional must not change alignment");
+    static_assert(std::is_trivially_copyable<optional_t>::value, "enum_optional must be trivially copyable");
+    optional_t opt;
+    std::cout << "empty optional has value: " << opt.has_value() << std::endl;
+    opt = descriptor_t::enum_type::fflush;
+    std::cout << "optional holds " << opt.value() << std::endl;
+    std::cout << std::endl;
+    // formatting without name lookups at runtime
+    std::cout << "streamed: " << descriptor_t::enum_type::fwrite << ", unknown: " << static_cast<descriptor_t::enum_type>(1) << std::endl;
+    char buffer[16];
+    fp::to_chars_result written = fp::to_chars(buffer, buffer + sizeof(buffer), descriptor_t::enum_type::fread);
+    std::cout << "to_chars: ";
+    std::cout.write(buffer, written.ptr - buffer) << std::endl;
+#if defined(__cpp_lib_format)
+    std::cout << std::format("formatted: [{:>8}] [{}]", descriptor_t::enum_type::fflush, static_cast<descriptor_t::enum_type>(1)) << std::endl;
+#endif
 
     return 0;
 }
\ No newline at end of file